@@ -1,3 +1,4 @@
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -6,20 +7,35 @@
 #include <sys/types.h>
 #include <fcntl.h>
 #include <time.h>
+#include <errno.h>
+#include <signal.h>
 #include "hash_utils.h"
+#include "mask_utils.h"
+#include "stream_utils.h"
+#include "tune_utils.h"
 
 /**
  * PROCESSO COORDENADOR - Mini-Projeto 1: Quebra de Senhas Paralelo
  * * Este programa coordena múltiplos workers para quebrar senhas MD5 em paralelo.
  * O MD5 JÁ ESTÁ IMPLEMENTADO - você deve focar na paralelização (fork/exec/wait).
- * * Uso: ./coordinator <hash_md5> <tamanho> <charset> <num_workers>
+ * * Uso: ./coordinator <hash_md5> <tamanho> <charset> <num_workers|auto>
  * * Exemplo: ./coordinator "900150983cd24fb0d6963f7d28e17f72" 3 "abc" 4
+ * * Em todos os modos, num_workers pode ser "auto" (ajuste por topologia e calibração)
+ * * Modo híbrido (palavra da wordlist + máscara):
+ * ./coordinator --hybrid <hash_md5> <wordlist> <mascara> <num_workers|auto> [sufixo|prefixo]
+ * * Modo stream (candidatos externos, um por linha, da entrada padrão ou de um arquivo):
+ * gerador | ./coordinator --stream <hash_md5> <num_workers|auto> [arquivo|-]
  * * SEU TRABALHO: Implementar os TODOs marcados abaixo
  */
 
 #define MAX_WORKERS 16
 #define RESULT_FILE "password_found.txt"
 #define MAX_PASSWORD_LEN 10
+#define HYBRID_FLAG "--hybrid"
+#define STREAM_FLAG "--stream"
+#define AUTO_WORKERS "auto"  // num_workers = auto: escolhe pela topologia e taxa medida
+#define AUTO_PENDING 0       // parse_num_workers: "auto", resolvido depois por tune_num_workers
+#define MAX_AUTO_WORKERS TUNE_MAX_CPUS  // No modo auto, até um worker por CPU permitido
 
 /**
  * Calcula o tamanho total do espaço de busca
@@ -53,6 +69,488 @@ void index_to_password(long long index, const char *charset, int charset_len,
     output[password_len] = '\0';
 }
 
+/**
+ * Lê o arquivo de resultado e imprime o resumo final da busca
+ * * @param start_time Instante em que os workers foram iniciados
+ */
+void print_result(time_t start_time) {
+    // Registrar tempo de fim
+    time_t end_time = time(NULL);
+    double elapsed_time = difftime(end_time, start_time);
+    
+    printf("\n=== Resultado ===\n");
+    
+    // TODO 9: Verificar se algum worker encontrou a senha
+    // Ler o arquivo password_found.txt se existir
+    
+    // IMPLEMENTE AQUI:
+    FILE *result_file = fopen(RESULT_FILE, "r");
+    if (result_file) {
+        // getline: senhas dos modos híbrido e stream podem ter qualquer tamanho
+        char *line = NULL;
+        size_t capacity = 0;
+        if (getline(&line, &capacity, result_file) != -1) {
+            char *password = strchr(line, ':');
+            if (password) {
+                password++; // Pula o ':'
+                password[strcspn(password, "\n")] = 0; // Remove a quebra de linha
+                printf("SENHA ENCONTRADA: %s\n", password);
+            }
+        }
+        free(line);
+        fclose(result_file);
+    } else {
+        printf("Senha não foi encontrada.\n");
+    }
+    
+    // Estatísticas finais (opcional)
+    printf("Tempo total de busca: %.2f segundos.\n", elapsed_time);
+}
+
+/**
+ * Interpreta o argumento num_workers: um número ou "auto"
+ * * @param arg Argumento da linha de comando
+ * @return Número de workers, AUTO_PENDING para "auto" ou -1 se inválido
+ */
+int parse_num_workers(const char *arg) {
+    if (strcmp(arg, AUTO_WORKERS) == 0) {
+        return AUTO_PENDING;
+    }
+    int num_workers = atoi(arg);
+    if (num_workers <= 0 || num_workers > MAX_WORKERS) {
+        fprintf(stderr, "Erro: O número de workers deve estar entre 1 e %d (ou %s).\n",
+                MAX_WORKERS, AUTO_WORKERS);
+        return -1;
+    }
+    return num_workers;
+}
+
+/**
+ * Resolve o modo automático depois que os demais argumentos foram validados
+ * * Lê a topologia dos CPUs, mede a taxa de hashes do caminho MD5 do modo com
+ * e sem os irmãos SMT e imprime a decisão. Sem limite de MAX_WORKERS: um
+ * worker por CPU escolhido. tune->num_workers fica 0 no modo manual.
+ * * @param num_workers Valor retornado por parse_num_workers
+ * @param kernel Caminho MD5 usado pelos workers do modo
+ * @param tune Saída: decisão do modo automático
+ * @return Número final de workers (0 se o ajuste automático falhar)
+ */
+int tune_num_workers(int num_workers, TuneKernel kernel, TuneResult *tune) {
+    tune->num_workers = 0;
+    if (num_workers != AUTO_PENDING) {
+        return num_workers;
+    }
+
+    printf("=== Ajuste automático de workers ===\n");
+    if (autotune_workers(kernel, tune) < 0) {
+        perror("Erro ao ler a topologia dos CPUs");
+        return 0;
+    }
+
+    printf("Topologia: %d CPUs permitidos, %d núcleos físicos, %d nó(s) NUMA\n",
+           tune->num_cpus, tune->num_cores, tune->num_nodes);
+    printf("Taxa medida com todos os CPUs lógicos: %.0f senhas/s\n", tune->rate_all);
+    if (tune->rate_cores > 0) {
+        printf("Taxa medida com um worker por núcleo: %.0f senhas/s\n", tune->rate_cores);
+    }
+    printf("Decisão: %d workers (%s), fixados nos CPUs", tune->num_workers,
+           tune->use_smt ? "usando SMT" : "um por núcleo físico");
+    for (int i = 0; i < tune->num_workers; i++) {
+        printf("%s%d", i == 0 ? " " : ",", tune->cpus[i]);
+    }
+    printf("\n\n");
+    return tune->num_workers;
+}
+
+/**
+ * No processo filho, antes do execl: no modo automático fixa o worker no CPU
+ * escolhido (a afinidade sobrevive ao execl). No modo manual não faz nada.
+ * * @param tune Decisão de tune_num_workers
+ * @param worker_id Índice do worker
+ */
+void pin_worker(const TuneResult *tune, int worker_id) {
+    if (tune->num_workers > 0) {
+        pin_to_cpu(tune->cpus[worker_id]);
+    }
+}
+
+/**
+ * Conta as palavras (linhas) da wordlist e registra o deslocamento em bytes
+ * onde começa a faixa de cada worker
+ * * @param wordlist Arquivo já aberto
+ * @param num_workers Número de faixas
+ * @param offsets Saída: deslocamento inicial de cada faixa
+ * @param counts Saída: quantidade de palavras de cada faixa
+ * @return Total de palavras da wordlist
+ */
+long long split_wordlist(FILE *wordlist, int num_workers, long long offsets[], long long counts[]) {
+    char *line = NULL;
+    size_t capacity = 0;
+    long long total_words = 0;
+
+    // Primeira passada: contar as palavras
+    while (getline(&line, &capacity, wordlist) != -1) {
+        total_words++;
+    }
+
+    long long words_per_worker = total_words / num_workers;
+    long long remaining = total_words % num_workers;
+    for (int i = 0; i < num_workers; i++) {
+        counts[i] = words_per_worker + (i < remaining ? 1 : 0);
+    }
+
+    // Segunda passada: guardar o byte onde cada faixa começa
+    rewind(wordlist);
+    long long word_index = 0;
+    long long next_start = 0;
+    int worker = 0;
+    while (worker < num_workers) {
+        if (word_index == next_start) {
+            offsets[worker] = ftell(wordlist);
+            next_start += counts[worker];
+            worker++;
+            continue;
+        }
+        if (getline(&line, &capacity, wordlist) == -1) {
+            break;
+        }
+        word_index++;
+    }
+    for (; worker < num_workers; worker++) {
+        offsets[worker] = ftell(wordlist);
+    }
+
+    free(line);
+    return total_words;
+}
+
+/**
+ * Modo híbrido: cada palavra da wordlist combinada com uma máscara
+ * como sufixo (padrão) ou prefixo. Os workers recebem faixas de palavras.
+ */
+int run_hybrid(int argc, char *argv[]) {
+    if (argc != 6 && argc != 7) {
+        fprintf(stderr, "Uso: %s %s <hash_md5> <wordlist> <mascara> <num_workers|auto> [sufixo|prefixo]\n",
+                argv[0], HYBRID_FLAG);
+        return 1;
+    }
+
+    const char *target_hash = argv[2];
+    const char *wordlist_path = argv[3];
+    const char *mask_text = argv[4];
+    int num_workers = parse_num_workers(argv[5]);
+    const char *position = argc == 7 ? argv[6] : "sufixo";
+
+    uint8_t target_digest[MD5_DIGEST_LENGTH];
+    if (!md5_hex_to_digest(target_hash, target_digest)) {
+        fprintf(stderr, "Erro: O hash alvo deve ter 32 dígitos hexadecimais.\n");
+        return 1;
+    }
+
+    Mask mask;
+    if (!parse_mask(mask_text, &mask)) {
+        fprintf(stderr, "Erro: Máscara inválida (máximo de %d posições; use ?l ?u ?d ?s ?a ?\?).\n",
+                MASK_MAX_POSITIONS);
+        return 1;
+    }
+    if (num_workers < 0) {
+        return 1;
+    }
+    if (strcmp(position, "sufixo") != 0 && strcmp(position, "prefixo") != 0) {
+        fprintf(stderr, "Erro: A posição da máscara deve ser 'sufixo' ou 'prefixo'.\n");
+        return 1;
+    }
+
+    FILE *wordlist = fopen(wordlist_path, "r");
+    if (!wordlist) {
+        perror("Erro ao abrir wordlist");
+        return 1;
+    }
+
+    TuneResult tune;
+    num_workers = tune_num_workers(num_workers, TUNE_KERNEL_BLOCK, &tune);
+    if (num_workers == 0) {
+        fclose(wordlist);
+        return 1;
+    }
+
+    long long offsets[MAX_AUTO_WORKERS];
+    long long counts[MAX_AUTO_WORKERS];
+    long long total_words = split_wordlist(wordlist, num_workers, offsets, counts);
+    fclose(wordlist);
+
+    printf("=== Mini-Projeto 1: Quebra de Senhas Paralelo (modo híbrido) ===\n");
+    printf("Hash MD5 alvo: %s\n", target_hash);
+    printf("Wordlist: %s (%lld palavras)\n", wordlist_path, total_words);
+    printf("Máscara: %s (%s, %.0f combinações por palavra)\n", mask_text, position, mask_keyspace(&mask));
+    printf("Número de workers: %d\n", num_workers);
+    printf("Espaço de busca total: %.0f combinações\n\n", total_words * mask_keyspace(&mask));
+
+    unlink(RESULT_FILE);
+    time_t start_time = time(NULL);
+
+    pid_t workers[MAX_AUTO_WORKERS];
+    int started = 0;
+
+    printf("Iniciando workers...\n");
+    for (int i = 0; i < num_workers; i++) {
+        if (counts[i] == 0) continue;
+
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork falhou");
+            exit(EXIT_FAILURE);
+        }
+
+        if (pid == 0) {
+            pin_worker(&tune, i);
+            char offset_str[24];
+            char count_str[24];
+            char id_str[8];
+            snprintf(offset_str, sizeof(offset_str), "%lld", offsets[i]);
+            snprintf(count_str, sizeof(count_str), "%lld", counts[i]);
+            snprintf(id_str, sizeof(id_str), "%d", i);
+            execl("./worker", "worker", HYBRID_FLAG, target_hash, wordlist_path, offset_str,
+                  count_str, mask_text, position, id_str, NULL);
+
+            perror("execl falhou");
+            exit(EXIT_FAILURE);
+        }
+        workers[started++] = pid;
+    }
+
+    printf("\nTodos os workers foram iniciados. Aguardando conclusão...\n");
+
+    for (int i = 0; i < started; i++) {
+        waitpid(workers[i], NULL, 0);
+    }
+
+    print_result(start_time);
+    return 0;
+}
+
+/**
+ * Pega um slot livre: primeiro os nunca usados, depois os devolvidos
+ * pelos workers na fila livre
+ * * @return 1 se obteve um slot, 0 se todos os workers já terminaram
+ */
+int acquire_slot(const StreamBuffer *stream, int *next_unused, int free_fd, int *slot) {
+    if (*next_unused < stream->header->num_slots) {
+        *slot = (*next_unused)++;
+        return 1;
+    }
+    return stream_recv_slot(free_fd, slot);
+}
+
+/**
+ * Modo stream: candidatos externos, um por linha, lidos da entrada padrão
+ * (ou de um arquivo/pipe) em blocos grandes e distribuídos aos workers por
+ * memória compartilhada. Cada bloco termina em uma quebra de linha; o
+ * pedaço de linha que sobra no fim é movido para o início do próximo bloco.
+ */
+int run_stream(int argc, char *argv[]) {
+    if (argc != 4 && argc != 5) {
+        fprintf(stderr, "Uso: %s %s <hash_md5> <num_workers|auto> [arquivo|-]\n", argv[0], STREAM_FLAG);
+        return 1;
+    }
+
+    const char *target_hash = argv[2];
+    int num_workers = parse_num_workers(argv[3]);
+    const char *input_path = argc == 5 ? argv[4] : "-";
+    uint8_t target_digest[MD5_DIGEST_LENGTH];
+
+    if (!md5_hex_to_digest(target_hash, target_digest)) {
+        fprintf(stderr, "Erro: O hash alvo deve ter 32 dígitos hexadecimais.\n");
+        return 1;
+    }
+    if (num_workers < 0) {
+        return 1;
+    }
+
+    int input_fd = STDIN_FILENO;
+    if (strcmp(input_path, "-") != 0) {
+        input_fd = open(input_path, O_RDONLY);
+        if (input_fd < 0) {
+            perror("Erro ao abrir arquivo de candidatos");
+            return 1;
+        }
+    }
+
+    StreamBuffer stream;
+    TuneResult tune;
+    num_workers = tune_num_workers(num_workers, TUNE_KERNEL_BATCH, &tune);
+    if (num_workers == 0) {
+        return 1;
+    }
+
+    int num_slots = STREAM_DEFAULT_SLOTS;
+    size_t block_size = STREAM_DEFAULT_BLOCK_SIZE;
+    if (tune.num_workers > 0) {
+        stream_size_for_rate(tune.rate_per_worker, num_workers, &num_slots, &block_size);
+    }
+    if (stream_create(&stream, num_slots, block_size) < 0) {
+        perror("Erro ao criar memória compartilhada");
+        return 1;
+    }
+
+    int work_pipe[2];
+    int free_pipe[2];
+    if (pipe(work_pipe) < 0 || pipe(free_pipe) < 0) {
+        perror("pipe falhou");
+        return 1;
+    }
+
+    printf("=== Mini-Projeto 1: Quebra de Senhas Paralelo (modo stream) ===\n");
+    printf("Hash MD5 alvo: %s\n", target_hash);
+    printf("Entrada: %s\n", strcmp(input_path, "-") == 0 ? "entrada padrão" : input_path);
+    printf("Número de workers: %d\n", num_workers);
+    printf("Blocos: %d x %zu KiB em memória compartilhada\n\n",
+           stream.header->num_slots, stream.header->block_size / 1024);
+
+    unlink(RESULT_FILE);
+    time_t start_time = time(NULL);
+
+    pid_t workers[MAX_AUTO_WORKERS];
+
+    printf("Iniciando workers...\n");
+    for (int i = 0; i < num_workers; i++) {
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork falhou");
+            exit(EXIT_FAILURE);
+        }
+
+        if (pid == 0) {
+            pin_worker(&tune, i);
+            char shm_str[12];
+            char work_str[12];
+            char free_str[12];
+            char id_str[8];
+
+            // O worker só lê da fila de trabalho e só escreve na fila livre
+            close(work_pipe[1]);
+            close(free_pipe[0]);
+            snprintf(shm_str, sizeof(shm_str), "%d", stream.fd);
+            snprintf(work_str, sizeof(work_str), "%d", work_pipe[0]);
+            snprintf(free_str, sizeof(free_str), "%d", free_pipe[1]);
+            snprintf(id_str, sizeof(id_str), "%d", i);
+            execl("./worker", "worker", STREAM_FLAG, target_hash, shm_str, work_str, free_str, id_str, NULL);
+
+            perror("execl falhou");
+            exit(EXIT_FAILURE);
+        }
+        workers[i] = pid;
+    }
+    close(work_pipe[0]);
+    close(free_pipe[1]);
+
+    // Workers que encerram cedo (senha encontrada) fecham o pipe; tratamos o EPIPE.
+    // Só depois do fork: SIG_IGN sobreviveria ao execl e valeria para o stdout dos workers
+    signal(SIGPIPE, SIG_IGN);
+
+    printf("\nTodos os workers foram iniciados. Distribuindo candidatos...\n");
+
+    int next_unused = 0;
+    int slot = -1;
+    int prev_slot = -1;
+    size_t carry = 0;          // Bytes de linha incompleta no fim do bloco anterior
+    int skipping_line = 0;     // Dentro de uma linha maior que o bloco: descartar até o próximo '\n'
+    long long dropped_lines = 0;
+    int eof = 0;
+    long long blocks_sent = 0;
+    long long bytes_sent = 0;
+
+    while (!eof || carry > 0) {
+        // Um slot cujo conteúdo foi descartado continua com o coordinator
+        if (slot < 0 && !acquire_slot(&stream, &next_unused, free_pipe[0], &slot)) {
+            break;  // Todos os workers terminaram
+        }
+
+        char *buffer = stream_slot(&stream, slot);
+        size_t fill = carry;
+        if (carry > 0) {
+            char *prev = stream_slot(&stream, prev_slot) + stream.header->lengths[prev_slot];
+            memmove(buffer, prev, carry);
+        }
+
+        // Leituras grandes direto no slot, sem cópia intermediária
+        while (!eof && fill < block_size) {
+            ssize_t n = read(input_fd, buffer + fill, block_size - fill);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                perror("Erro ao ler candidatos");
+                eof = 1;
+            } else if (n == 0) {
+                eof = 1;
+            } else if (skipping_line) {
+                char *newline = memchr(buffer + fill, '\n', n);
+                if (newline) {
+                    size_t rest = buffer + fill + n - (newline + 1);
+                    memmove(buffer + fill, newline + 1, rest);
+                    fill += rest;
+                    skipping_line = 0;
+                }
+            } else {
+                fill += n;
+            }
+        }
+
+        size_t length = fill;
+        carry = 0;
+        if (!eof) {
+            char *last_newline = memrchr(buffer, '\n', fill);
+            if (!last_newline) {
+                // Linha maior que o bloco: descarta o bloco e o resto da linha (contada no resumo)
+                skipping_line = 1;
+                dropped_lines++;
+                continue;
+            }
+            length = last_newline - buffer + 1;
+            carry = fill - length;
+        }
+
+        if (length == 0) {
+            break;
+        }
+
+        stream.header->lengths[slot] = length;
+        if (!stream_send_slot(work_pipe[1], slot)) {
+            break;
+        }
+        prev_slot = slot;
+        slot = -1;
+        blocks_sent++;
+        bytes_sent += length;
+
+        if (access(RESULT_FILE, F_OK) == 0) {
+            break;
+        }
+    }
+
+    // Um sinal de fim por worker; quem já saiu simplesmente não lê
+    for (int i = 0; i < num_workers; i++) {
+        stream_send_slot(work_pipe[1], STREAM_END_SLOT);
+    }
+    close(work_pipe[1]);
+
+    for (int i = 0; i < num_workers; i++) {
+        waitpid(workers[i], NULL, 0);
+    }
+
+    close(free_pipe[0]);
+    stream_destroy(&stream);
+    if (input_fd != STDIN_FILENO) {
+        close(input_fd);
+    }
+
+    printf("Blocos distribuídos: %lld (%.1f MiB)\n", blocks_sent, bytes_sent / (1024.0 * 1024.0));
+    if (dropped_lines > 0) {
+        printf("Linhas descartadas por serem maiores que um bloco: %lld\n", dropped_lines);
+    }
+    print_result(start_time);
+    return 0;
+}
+
 /**
  * Função principal do coordenador
  */
@@ -62,8 +560,17 @@ int main(int argc, char *argv[]) {
     // Se não, imprimir mensagem de uso e sair com código 1
     
     // IMPLEMENTE AQUI: verificação de argc e mensagem de erro
+    if (argc > 1 && strcmp(argv[1], HYBRID_FLAG) == 0) {
+        return run_hybrid(argc, argv);
+    }
+    if (argc > 1 && strcmp(argv[1], STREAM_FLAG) == 0) {
+        return run_stream(argc, argv);
+    }
     if (argc != 5) {
-        fprintf(stderr, "Uso: %s <hash_md5> <tamanho> <charset> <num_workers>\n", argv[0]);
+        fprintf(stderr, "Uso: %s <hash_md5> <tamanho> <charset> <num_workers|auto>\n", argv[0]);
+        fprintf(stderr, "     %s %s <hash_md5> <wordlist> <mascara> <num_workers|auto> [sufixo|prefixo]\n",
+                argv[0], HYBRID_FLAG);
+        fprintf(stderr, "     %s %s <hash_md5> <num_workers|auto> [arquivo|-]\n", argv[0], STREAM_FLAG);
         return 1;
     }
     
@@ -71,7 +578,7 @@ int main(int argc, char *argv[]) {
     const char *target_hash = argv[1];
     int password_len = atoi(argv[2]);
     const char *charset = argv[3];
-    int num_workers = atoi(argv[4]);
+    int num_workers = parse_num_workers(argv[4]);
     int charset_len = strlen(charset);
     
     // TODO: Adicionar validações dos parâmetros
@@ -82,8 +589,7 @@ int main(int argc, char *argv[]) {
         fprintf(stderr, "Erro: O tamanho da senha deve estar entre 1 e %d.\n", MAX_PASSWORD_LEN);
         return 1;
     }
-    if (num_workers <= 0 || num_workers > MAX_WORKERS) {
-        fprintf(stderr, "Erro: O número de workers deve estar entre 1 e %d.\n", MAX_WORKERS);
+    if (num_workers < 0) {
         return 1;
     }
     if (charset_len == 0) {
@@ -91,6 +597,12 @@ int main(int argc, char *argv[]) {
         return 1;
     }
     
+    TuneResult tune;
+    num_workers = tune_num_workers(num_workers, TUNE_KERNEL_STRING, &tune);
+    if (num_workers == 0) {
+        return 1;
+    }
+    
     printf("=== Mini-Projeto 1: Quebra de Senhas Paralelo ===\n");
     printf("Hash MD5 alvo: %s\n", target_hash);
     printf("Tamanho da senha: %d\n", password_len);
@@ -116,7 +628,7 @@ int main(int argc, char *argv[]) {
     long long remaining = total_space % num_workers;
     
     // Arrays para armazenar PIDs dos workers
-    pid_t workers[MAX_WORKERS];
+    pid_t workers[MAX_AUTO_WORKERS];
     
     // TODO 3: Criar os processos workers usando fork()
     printf("Iniciando workers...\n");
@@ -126,7 +638,11 @@ int main(int argc, char *argv[]) {
     for (int i = 0; i < num_workers; i++) {
         // TODO: Calcular intervalo de senhas para este worker
         long long chunk_size = passwords_per_worker + (i < remaining ? 1 : 0);
-        if (chunk_size == 0) continue;
+        if (chunk_size == 0) {
+            // Mais workers do que combinações (possível no modo auto): nada a iniciar
+            workers[i] = -1;
+            continue;
+        }
         long long end_index = current_start_index + chunk_size - 1;
 
         // TODO: Converter indices para senhas de inicio e fim
@@ -145,9 +661,10 @@ int main(int argc, char *argv[]) {
         }
 
         if (pid == 0) {
+            pin_worker(&tune, i);
             // TODO 6: No processo filho: usar execl() para executar worker
             char len_str[4];
-            char id_str[4];
+            char id_str[8];
             snprintf(len_str, sizeof(len_str), "%d", password_len);
             snprintf(id_str, sizeof(id_str), "%d", i);
             execl("./worker", "worker", target_hash, start_password, end_password, charset, len_str, id_str, NULL);
@@ -169,37 +686,12 @@ int main(int argc, char *argv[]) {
     
     // IMPLEMENTE AQUI:
     for (int i = 0; i < num_workers; i++) {
-        waitpid(workers[i], NULL, 0);
-    }
-    
-    // Registrar tempo de fim
-    time_t end_time = time(NULL);
-    double elapsed_time = difftime(end_time, start_time);
-    
-    printf("\n=== Resultado ===\n");
-    
-    // TODO 9: Verificar se algum worker encontrou a senha
-    // Ler o arquivo password_found.txt se existir
-    
-    // IMPLEMENTE AQUI:
-    FILE *result_file = fopen(RESULT_FILE, "r");
-    if (result_file) {
-        char line[256];
-        if (fgets(line, sizeof(line), result_file)) {
-            char *password = strchr(line, ':');
-            if (password) {
-                password++; // Pula o ':'
-                password[strcspn(password, "\n")] = 0; // Remove a quebra de linha
-                printf("SENHA ENCONTRADA: %s\n", password);
-            }
+        if (workers[i] > 0) {
+            waitpid(workers[i], NULL, 0);
         }
-        fclose(result_file);
-    } else {
-        printf("Senha não foi encontrada.\n");
     }
     
-    // Estatísticas finais (opcional)
-    printf("Tempo total de busca: %.2f segundos.\n", elapsed_time);
+    print_result(start_time);
     
     return 0;
 }
\ No newline at end of file
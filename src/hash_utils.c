@@ -60,6 +60,77 @@ static uint8_t PADDING[64] = {
     (a) += (b); \
 }
 
+/* As 64 operações do MD5, compartilhadas pela versão escalar e pela versão em lotes */
+#define MD5_ROUNDS(a, b, c, d, x) { \
+    FF(a, b, c, d, x[ 0], S11, 0xd76aa478); \
+    FF(d, a, b, c, x[ 1], S12, 0xe8c7b756); \
+    FF(c, d, a, b, x[ 2], S13, 0x242070db); \
+    FF(b, c, d, a, x[ 3], S14, 0xc1bdceee); \
+    FF(a, b, c, d, x[ 4], S11, 0xf57c0faf); \
+    FF(d, a, b, c, x[ 5], S12, 0x4787c62a); \
+    FF(c, d, a, b, x[ 6], S13, 0xa8304613); \
+    FF(b, c, d, a, x[ 7], S14, 0xfd469501); \
+    FF(a, b, c, d, x[ 8], S11, 0x698098d8); \
+    FF(d, a, b, c, x[ 9], S12, 0x8b44f7af); \
+    FF(c, d, a, b, x[10], S13, 0xffff5bb1); \
+    FF(b, c, d, a, x[11], S14, 0x895cd7be); \
+    FF(a, b, c, d, x[12], S11, 0x6b901122); \
+    FF(d, a, b, c, x[13], S12, 0xfd987193); \
+    FF(c, d, a, b, x[14], S13, 0xa679438e); \
+    FF(b, c, d, a, x[15], S14, 0x49b40821); \
+ \
+    GG(a, b, c, d, x[ 1], S21, 0xf61e2562); \
+    GG(d, a, b, c, x[ 6], S22, 0xc040b340); \
+    GG(c, d, a, b, x[11], S23, 0x265e5a51); \
+    GG(b, c, d, a, x[ 0], S24, 0xe9b6c7aa); \
+    GG(a, b, c, d, x[ 5], S21, 0xd62f105d); \
+    GG(d, a, b, c, x[10], S22,  0x2441453); \
+    GG(c, d, a, b, x[15], S23, 0xd8a1e681); \
+    GG(b, c, d, a, x[ 4], S24, 0xe7d3fbc8); \
+    GG(a, b, c, d, x[ 9], S21, 0x21e1cde6); \
+    GG(d, a, b, c, x[14], S22, 0xc33707d6); \
+    GG(c, d, a, b, x[ 3], S23, 0xf4d50d87); \
+    GG(b, c, d, a, x[ 8], S24, 0x455a14ed); \
+    GG(a, b, c, d, x[13], S21, 0xa9e3e905); \
+    GG(d, a, b, c, x[ 2], S22, 0xfcefa3f8); \
+    GG(c, d, a, b, x[ 7], S23, 0x676f02d9); \
+    GG(b, c, d, a, x[12], S24, 0x8d2a4c8a); \
+ \
+    HH(a, b, c, d, x[ 5], S31, 0xfffa3942); \
+    HH(d, a, b, c, x[ 8], S32, 0x8771f681); \
+    HH(c, d, a, b, x[11], S33, 0x6d9d6122); \
+    HH(b, c, d, a, x[14], S34, 0xfde5380c); \
+    HH(a, b, c, d, x[ 1], S31, 0xa4beea44); \
+    HH(d, a, b, c, x[ 4], S32, 0x4bdecfa9); \
+    HH(c, d, a, b, x[ 7], S33, 0xf6bb4b60); \
+    HH(b, c, d, a, x[10], S34, 0xbebfbc70); \
+    HH(a, b, c, d, x[13], S31, 0x289b7ec6); \
+    HH(d, a, b, c, x[ 0], S32, 0xeaa127fa); \
+    HH(c, d, a, b, x[ 3], S33, 0xd4ef3085); \
+    HH(b, c, d, a, x[ 6], S34,  0x4881d05); \
+    HH(a, b, c, d, x[ 9], S31, 0xd9d4d039); \
+    HH(d, a, b, c, x[12], S32, 0xe6db99e5); \
+    HH(c, d, a, b, x[15], S33, 0x1fa27cf8); \
+    HH(b, c, d, a, x[ 2], S34, 0xc4ac5665); \
+ \
+    II(a, b, c, d, x[ 0], S41, 0xf4292244); \
+    II(d, a, b, c, x[ 7], S42, 0x432aff97); \
+    II(c, d, a, b, x[14], S43, 0xab9423a7); \
+    II(b, c, d, a, x[ 5], S44, 0xfc93a039); \
+    II(a, b, c, d, x[12], S41, 0x655b59c3); \
+    II(d, a, b, c, x[ 3], S42, 0x8f0ccc92); \
+    II(c, d, a, b, x[10], S43, 0xffeff47d); \
+    II(b, c, d, a, x[ 1], S44, 0x85845dd1); \
+    II(a, b, c, d, x[ 8], S41, 0x6fa87e4f); \
+    II(d, a, b, c, x[15], S42, 0xfe2ce6e0); \
+    II(c, d, a, b, x[ 6], S43, 0xa3014314); \
+    II(b, c, d, a, x[13], S44, 0x4e0811a1); \
+    II(a, b, c, d, x[ 4], S41, 0xf7537e82); \
+    II(d, a, b, c, x[11], S42, 0xbd3af235); \
+    II(c, d, a, b, x[ 2], S43, 0x2ad7d2bb); \
+    II(b, c, d, a, x[ 9], S44, 0xeb86d391); \
+}
+
 static void MD5Transform(uint32_t state[4], const uint8_t block[64]);
 static void Encode(uint8_t *output, const uint32_t *input, size_t len);
 static void Decode(uint32_t *output, const uint8_t *input, size_t len);
@@ -120,73 +191,7 @@ static void MD5Transform(uint32_t state[4], const uint8_t block[64]) {
 
     Decode(x, block, 64);
 
-    FF(a, b, c, d, x[ 0], S11, 0xd76aa478);
-    FF(d, a, b, c, x[ 1], S12, 0xe8c7b756);
-    FF(c, d, a, b, x[ 2], S13, 0x242070db);
-    FF(b, c, d, a, x[ 3], S14, 0xc1bdceee);
-    FF(a, b, c, d, x[ 4], S11, 0xf57c0faf);
-    FF(d, a, b, c, x[ 5], S12, 0x4787c62a);
-    FF(c, d, a, b, x[ 6], S13, 0xa8304613);
-    FF(b, c, d, a, x[ 7], S14, 0xfd469501);
-    FF(a, b, c, d, x[ 8], S11, 0x698098d8);
-    FF(d, a, b, c, x[ 9], S12, 0x8b44f7af);
-    FF(c, d, a, b, x[10], S13, 0xffff5bb1);
-    FF(b, c, d, a, x[11], S14, 0x895cd7be);
-    FF(a, b, c, d, x[12], S11, 0x6b901122);
-    FF(d, a, b, c, x[13], S12, 0xfd987193);
-    FF(c, d, a, b, x[14], S13, 0xa679438e);
-    FF(b, c, d, a, x[15], S14, 0x49b40821);
-
-    GG(a, b, c, d, x[ 1], S21, 0xf61e2562);
-    GG(d, a, b, c, x[ 6], S22, 0xc040b340);
-    GG(c, d, a, b, x[11], S23, 0x265e5a51);
-    GG(b, c, d, a, x[ 0], S24, 0xe9b6c7aa);
-    GG(a, b, c, d, x[ 5], S21, 0xd62f105d);
-    GG(d, a, b, c, x[10], S22,  0x2441453);
-    GG(c, d, a, b, x[15], S23, 0xd8a1e681);
-    GG(b, c, d, a, x[ 4], S24, 0xe7d3fbc8);
-    GG(a, b, c, d, x[ 9], S21, 0x21e1cde6);
-    GG(d, a, b, c, x[14], S22, 0xc33707d6);
-    GG(c, d, a, b, x[ 3], S23, 0xf4d50d87);
-    GG(b, c, d, a, x[ 8], S24, 0x455a14ed);
-    GG(a, b, c, d, x[13], S21, 0xa9e3e905);
-    GG(d, a, b, c, x[ 2], S22, 0xfcefa3f8);
-    GG(c, d, a, b, x[ 7], S23, 0x676f02d9);
-    GG(b, c, d, a, x[12], S24, 0x8d2a4c8a);
-
-    HH(a, b, c, d, x[ 5], S31, 0xfffa3942);
-    HH(d, a, b, c, x[ 8], S32, 0x8771f681);
-    HH(c, d, a, b, x[11], S33, 0x6d9d6122);
-    HH(b, c, d, a, x[14], S34, 0xfde5380c);
-    HH(a, b, c, d, x[ 1], S31, 0xa4beea44);
-    HH(d, a, b, c, x[ 4], S32, 0x4bdecfa9);
-    HH(c, d, a, b, x[ 7], S33, 0xf6bb4b60);
-    HH(b, c, d, a, x[10], S34, 0xbebfbc70);
-    HH(a, b, c, d, x[13], S31, 0x289b7ec6);
-    HH(d, a, b, c, x[ 0], S32, 0xeaa127fa);
-    HH(c, d, a, b, x[ 3], S33, 0xd4ef3085);
-    HH(b, c, d, a, x[ 6], S34,  0x4881d05);
-    HH(a, b, c, d, x[ 9], S31, 0xd9d4d039);
-    HH(d, a, b, c, x[12], S32, 0xe6db99e5);
-    HH(c, d, a, b, x[15], S33, 0x1fa27cf8);
-    HH(b, c, d, a, x[ 2], S34, 0xc4ac5665);
-
-    II(a, b, c, d, x[ 0], S41, 0xf4292244);
-    II(d, a, b, c, x[ 7], S42, 0x432aff97);
-    II(c, d, a, b, x[14], S43, 0xab9423a7);
-    II(b, c, d, a, x[ 5], S44, 0xfc93a039);
-    II(a, b, c, d, x[12], S41, 0x655b59c3);
-    II(d, a, b, c, x[ 3], S42, 0x8f0ccc92);
-    II(c, d, a, b, x[10], S43, 0xffeff47d);
-    II(b, c, d, a, x[ 1], S44, 0x85845dd1);
-    II(a, b, c, d, x[ 8], S41, 0x6fa87e4f);
-    II(d, a, b, c, x[15], S42, 0xfe2ce6e0);
-    II(c, d, a, b, x[ 6], S43, 0xa3014314);
-    II(b, c, d, a, x[13], S44, 0x4e0811a1);
-    II(a, b, c, d, x[ 4], S41, 0xf7537e82);
-    II(d, a, b, c, x[11], S42, 0xbd3af235);
-    II(c, d, a, b, x[ 2], S43, 0x2ad7d2bb);
-    II(b, c, d, a, x[ 9], S44, 0xeb86d391);
+    MD5_ROUNDS(a, b, c, d, x);
 
     state[0] += a;
     state[1] += b;
@@ -241,4 +246,124 @@ void md5_string(const char *input, char output[33]) {
         sprintf(output + (i * 2), "%02x", digest[i]);
     }
     output[32] = '\0';
-}
\ No newline at end of file
+}
+
+/**
+ * Digest binário de uma mensagem de qualquer tamanho (vários blocos)
+ */
+void md5_digest(const uint8_t *data, size_t len, uint8_t digest[MD5_DIGEST_LENGTH]) {
+    MD5_CTX ctx;
+
+    MD5Init(&ctx);
+    MD5Update(&ctx, data, len);
+    MD5Final(digest, &ctx);
+}
+
+/**
+ * Prepara um bloco único com padding e comprimento para len bytes
+ */
+int md5_block_init(uint8_t block[MD5_BLOCK_SIZE], size_t len) {
+    uint32_t bits[2];
+
+    if (len > MD5_MAX_BLOCK_MESSAGE) {
+        return 0;
+    }
+
+    memset(block, 0, MD5_BLOCK_SIZE);
+    block[len] = 0x80;
+
+    bits[0] = (uint32_t)(len << 3);
+    bits[1] = 0;
+    Encode(&block[56], bits, 8);
+    return 1;
+}
+
+/**
+ * Processa um bloco já preparado a partir do estado inicial do MD5
+ */
+void md5_block_digest(const uint8_t block[MD5_BLOCK_SIZE], uint8_t digest[MD5_DIGEST_LENGTH]) {
+    uint32_t state[4] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 };
+
+    MD5Transform(state, block);
+    Encode(digest, state, 16);
+}
+
+#if defined(__GNUC__)
+// Cada variável do MD5 vira um vetor com uma palavra por candidato (SIMD via extensões do GCC)
+typedef uint32_t md5_lanes __attribute__((vector_size(MD5_BATCH_SIZE * sizeof(uint32_t))));
+
+/**
+ * Processa MD5_BATCH_SIZE blocos em paralelo, um por lane do vetor
+ */
+static void md5_block_digest_lanes(const uint8_t blocks[][MD5_BLOCK_SIZE],
+                                   uint8_t digests[][MD5_DIGEST_LENGTH]) {
+    md5_lanes a, b, c, d, x[16];
+    uint32_t words[16];
+    int i, lane;
+
+    for (lane = 0; lane < MD5_BATCH_SIZE; lane++) {
+        Decode(words, blocks[lane], 64);
+        for (i = 0; i < 16; i++) {
+            x[i][lane] = words[i];
+        }
+    }
+
+    a = (md5_lanes){ 0 } + 0x67452301;
+    b = (md5_lanes){ 0 } + 0xefcdab89;
+    c = (md5_lanes){ 0 } + 0x98badcfe;
+    d = (md5_lanes){ 0 } + 0x10325476;
+
+    MD5_ROUNDS(a, b, c, d, x);
+
+    for (lane = 0; lane < MD5_BATCH_SIZE; lane++) {
+        uint32_t state[4] = {
+            a[lane] + 0x67452301, b[lane] + 0xefcdab89,
+            c[lane] + 0x98badcfe, d[lane] + 0x10325476
+        };
+        Encode(digests[lane], state, 16);
+    }
+}
+#endif
+
+/**
+ * Calcula o digest de vários blocos, MD5_BATCH_SIZE por vez quando possível
+ */
+void md5_block_digest_batch(const uint8_t blocks[][MD5_BLOCK_SIZE],
+                            uint8_t digests[][MD5_DIGEST_LENGTH], size_t count) {
+    size_t i = 0;
+
+#if defined(__GNUC__)
+    for (; i + MD5_BATCH_SIZE <= count; i += MD5_BATCH_SIZE) {
+        md5_block_digest_lanes(&blocks[i], &digests[i]);
+    }
+#endif
+
+    for (; i < count; i++) {
+        md5_block_digest(blocks[i], digests[i]);
+    }
+}
+
+/**
+ * Converte 32 dígitos hexadecimais para os 16 bytes do digest
+ */
+int md5_hex_to_digest(const char *hex, uint8_t digest[MD5_DIGEST_LENGTH]) {
+    int i;
+
+    if (hex == NULL || strlen(hex) != 2 * MD5_DIGEST_LENGTH) {
+        return 0;
+    }
+
+    for (i = 0; i < 2 * MD5_DIGEST_LENGTH; i++) {
+        char c = hex[i];
+        int value;
+
+        if (c >= '0' && c <= '9') value = c - '0';
+        else if (c >= 'a' && c <= 'f') value = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') value = c - 'A' + 10;
+        else return 0;
+
+        if (i % 2 == 0) digest[i / 2] = (uint8_t)(value << 4);
+        else digest[i / 2] |= (uint8_t)value;
+    }
+    return 1;
+}
@@ -21,4 +21,62 @@
  */
 void md5_string(const char *input, char output[33]);
 
+/**
+ * Computa o digest MD5 binário de um buffer de qualquer tamanho
+ * 
+ * Diferente de md5_string, não exige '\0' no final e não converte para hexadecimal.
+ * 
+ * @param data Bytes da mensagem
+ * @param len Tamanho da mensagem
+ * @param digest Buffer de saída com 16 bytes
+ */
+void md5_digest(const uint8_t *data, size_t len, uint8_t digest[MD5_DIGEST_LENGTH]);
+
+#define MD5_BLOCK_SIZE 64
+#define MD5_MAX_BLOCK_MESSAGE 55  // Maior mensagem que cabe em um único bloco
+
+/**
+ * Prepara um bloco MD5 para uma mensagem de tamanho fixo
+ * 
+ * Zera o bloco, grava o byte de padding 0x80 e o comprimento em bits.
+ * Os bytes da mensagem (posições 0..len-1) devem ser escritos pelo chamador,
+ * e podem ser reescritos entre chamadas a md5_block_digest sem preparar de novo.
+ * 
+ * @param block Bloco de 64 bytes
+ * @param len Tamanho da mensagem (no máximo MD5_MAX_BLOCK_MESSAGE)
+ * @return 1 se preparado, 0 se a mensagem não cabe em um bloco
+ */
+int md5_block_init(uint8_t block[MD5_BLOCK_SIZE], size_t len);
+
+/**
+ * Calcula o digest MD5 de um bloco preparado por md5_block_init
+ * 
+ * @param block Bloco de 64 bytes já preenchido
+ * @param digest Buffer de saída com 16 bytes (binário, não hexadecimal)
+ */
+void md5_block_digest(const uint8_t block[MD5_BLOCK_SIZE], uint8_t digest[MD5_DIGEST_LENGTH]);
+
+#define MD5_BATCH_SIZE 4  // Blocos processados juntos por md5_block_digest_batch
+
+/**
+ * Calcula o digest MD5 de vários blocos preparados por md5_block_init
+ * 
+ * Os blocos são processados em grupos de MD5_BATCH_SIZE usando instruções
+ * vetoriais (quando o compilador suporta), o que é mais rápido do que
+ * chamar md5_block_digest para cada um.
+ * 
+ * @param blocks Blocos de 64 bytes já preenchidos
+ * @param digests Saída: um digest binário de 16 bytes por bloco
+ * @param count Número de blocos
+ */
+void md5_block_digest_batch(const uint8_t blocks[][MD5_BLOCK_SIZE],
+                            uint8_t digests[][MD5_DIGEST_LENGTH], size_t count);
+
+/**
+ * Converte um hash hexadecimal (32 caracteres) para o digest binário
+ * 
+ * @return 1 se convertido, 0 se a string não é um hash MD5 válido
+ */
+int md5_hex_to_digest(const char *hex, uint8_t digest[MD5_DIGEST_LENGTH]);
+
 #endif // HASH_UTILS_H
\ No newline at end of file
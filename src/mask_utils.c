@@ -0,0 +1,57 @@
+#include <string.h>
+#include "mask_utils.h"
+
+#define MASK_LOWER "abcdefghijklmnopqrstuvwxyz"
+#define MASK_UPPER "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+#define MASK_DIGIT "0123456789"
+#define MASK_SYMBOL " !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~"
+
+/**
+ * Preenche uma posição da máscara com um conjunto de caracteres
+ */
+static void set_position(Mask *mask, const char *chars) {
+    int pos = mask->length;
+    int count = strlen(chars);
+
+    memcpy(mask->chars[pos], chars, count);
+    mask->counts[pos] = count;
+    mask->length++;
+}
+
+int parse_mask(const char *text, Mask *mask) {
+    mask->length = 0;
+
+    while (*text) {
+        if (mask->length == MASK_MAX_POSITIONS) {
+            return 0;
+        }
+
+        if (*text != '?') {
+            char literal[2] = { *text, '\0' };
+            set_position(mask, literal);
+            text++;
+            continue;
+        }
+
+        switch (text[1]) {
+            case 'l': set_position(mask, MASK_LOWER); break;
+            case 'u': set_position(mask, MASK_UPPER); break;
+            case 'd': set_position(mask, MASK_DIGIT); break;
+            case 's': set_position(mask, MASK_SYMBOL); break;
+            case 'a': set_position(mask, MASK_LOWER MASK_UPPER MASK_DIGIT MASK_SYMBOL); break;
+            case '?': set_position(mask, "?"); break;
+            default: return 0;
+        }
+        text += 2;
+    }
+
+    return mask->length > 0;
+}
+
+double mask_keyspace(const Mask *mask) {
+    double total = 1;
+    for (int i = 0; i < mask->length; i++) {
+        total *= mask->counts[i];
+    }
+    return total;
+}
@@ -0,0 +1,38 @@
+#ifndef MASK_UTILS_H
+#define MASK_UTILS_H
+
+#define MASK_MAX_POSITIONS 10
+#define MASK_MAX_CHARSET 96
+
+/**
+ * Máscara de candidatos no estilo "?d?d?s"
+ * 
+ * Cada posição tem o seu próprio conjunto de caracteres:
+ *   ?l = a-z    ?u = A-Z    ?d = 0-9    ?s = símbolos
+ *   ?a = todos os anteriores    ?? = o caractere '?'
+ * Qualquer outro caractere é literal (ocupa uma posição com um único valor).
+ */
+typedef struct {
+    int length;
+    int counts[MASK_MAX_POSITIONS];
+    char chars[MASK_MAX_POSITIONS][MASK_MAX_CHARSET];
+} Mask;
+
+/**
+ * Interpreta o texto de uma máscara
+ * 
+ * @param text Texto da máscara (ex: "?d?d?d?s")
+ * @param mask Estrutura de saída
+ * @return 1 se válida, 0 se vazia, malformada ou com mais de MASK_MAX_POSITIONS posições
+ */
+int parse_mask(const char *text, Mask *mask);
+
+/**
+ * Calcula quantos candidatos a máscara gera
+ * 
+ * Retorna double porque a maior máscara aceita (?a repetido 10 vezes,
+ * 95^10 combinações) não cabe em um long long.
+ */
+double mask_keyspace(const Mask *mask);
+
+#endif // MASK_UTILS_H
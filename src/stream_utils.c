@@ -0,0 +1,111 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "stream_utils.h"
+
+#define STREAM_BLOCK_SECONDS 0.02  // Tempo de hashing desejado por bloco
+#define STREAM_TYPICAL_LINE 10     // Bytes médios estimados por candidato
+
+int stream_create(StreamBuffer *stream, int num_slots, size_t block_size) {
+    if (num_slots <= 0 || num_slots > STREAM_MAX_SLOTS || block_size == 0) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    // Sem MFD_CLOEXEC: o descritor precisa sobreviver ao execl() dos workers
+    stream->fd = memfd_create("quebrasenhas-stream", 0);
+    if (stream->fd < 0) {
+        return -1;
+    }
+
+    stream->map_size = sizeof(StreamHeader) + (size_t)num_slots * block_size;
+    if (ftruncate(stream->fd, stream->map_size) < 0) {
+        close(stream->fd);
+        return -1;
+    }
+
+    void *base = mmap(NULL, stream->map_size, PROT_READ | PROT_WRITE, MAP_SHARED, stream->fd, 0);
+    if (base == MAP_FAILED) {
+        close(stream->fd);
+        return -1;
+    }
+
+    stream->header = base;
+    stream->header->block_size = block_size;
+    stream->header->num_slots = num_slots;
+    stream->data = (char *)base + sizeof(StreamHeader);
+    return 0;
+}
+
+void stream_size_for_rate(double rate_per_worker, int num_workers, int *num_slots, size_t *block_size) {
+    size_t target = (size_t)(rate_per_worker * STREAM_BLOCK_SECONDS * STREAM_TYPICAL_LINE);
+
+    *block_size = STREAM_MIN_BLOCK_SIZE;
+    while (*block_size < target && *block_size < STREAM_MAX_BLOCK_SIZE) {
+        *block_size *= 2;
+    }
+
+    // Quatro slots por worker mantêm todos ocupados enquanto o coordinator lê a entrada
+    *num_slots = 4 * num_workers;
+    if (*num_slots > STREAM_MAX_SLOTS) {
+        *num_slots = STREAM_MAX_SLOTS;
+    }
+    while ((size_t)*num_slots * *block_size > STREAM_MAX_BUFFER && *block_size > STREAM_MIN_BLOCK_SIZE) {
+        *block_size /= 2;
+    }
+}
+
+int stream_attach(StreamBuffer *stream, int fd) {
+    struct stat info;
+
+    if (fstat(fd, &info) < 0) {
+        return -1;
+    }
+    if ((size_t)info.st_size < sizeof(StreamHeader)) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    void *base = mmap(NULL, info.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        return -1;
+    }
+
+    stream->fd = fd;
+    stream->map_size = info.st_size;
+    stream->header = base;
+    stream->data = (char *)base + sizeof(StreamHeader);
+    return 0;
+}
+
+void stream_destroy(StreamBuffer *stream) {
+    munmap(stream->header, stream->map_size);
+    close(stream->fd);
+}
+
+char *stream_slot(const StreamBuffer *stream, int slot) {
+    return stream->data + (size_t)slot * stream->header->block_size;
+}
+
+int stream_send_slot(int fd, int slot) {
+    ssize_t written;
+
+    // sizeof(int) < PIPE_BUF: a escrita é atômica mesmo com vários leitores
+    do {
+        written = write(fd, &slot, sizeof(slot));
+    } while (written < 0 && errno == EINTR);
+
+    return written == sizeof(slot);
+}
+
+int stream_recv_slot(int fd, int *slot) {
+    ssize_t received;
+
+    do {
+        received = read(fd, slot, sizeof(*slot));
+    } while (received < 0 && errno == EINTR);
+
+    return received == sizeof(*slot);
+}
@@ -0,0 +1,87 @@
+#ifndef STREAM_UTILS_H
+#define STREAM_UTILS_H
+
+#include <stddef.h>
+
+#define STREAM_MAX_SLOTS 4096
+#define STREAM_DEFAULT_SLOTS 32
+#define STREAM_DEFAULT_BLOCK_SIZE (1 << 20)  // 1 MiB de candidatos por bloco
+#define STREAM_MIN_BLOCK_SIZE (64 * 1024)
+#define STREAM_MAX_BLOCK_SIZE (4 << 20)
+#define STREAM_MAX_BUFFER (256 << 20)        // Limite da memória compartilhada somando todos os slots
+#define STREAM_END_SLOT -1                   // Sinal de fim enviado a cada worker
+
+/**
+ * Memória compartilhada do modo stream
+ * 
+ * O coordinator lê candidatos (um por linha) em blocos grandes diretamente
+ * para os slots desta região. Os workers recebem o índice do slot pela
+ * "fila de trabalho" (um pipe) e devolvem o índice pela "fila livre" quando
+ * terminam de processá-lo. Só índices trafegam pelos pipes: um write/read
+ * por bloco, nunca por linha.
+ * 
+ * A região é criada com memfd_create e o descritor é herdado pelos workers
+ * através do fork()/execl().
+ */
+typedef struct {
+    size_t block_size;                 // Capacidade de cada slot em bytes
+    int num_slots;                     // Slots em circulação
+    size_t lengths[STREAM_MAX_SLOTS];  // Bytes válidos em cada slot
+} StreamHeader;
+
+typedef struct {
+    int fd;               // Descritor da memória compartilhada
+    size_t map_size;      // Tamanho total mapeado
+    StreamHeader *header; // Início da região
+    char *data;           // Slots, um após o outro
+} StreamBuffer;
+
+/**
+ * Cria a memória compartilhada (lado do coordinator)
+ * 
+ * @return 0 em sucesso, -1 em erro (errno preenchido)
+ */
+int stream_create(StreamBuffer *stream, int num_slots, size_t block_size);
+
+/**
+ * Dimensiona os slots a partir da taxa medida de cada worker
+ * 
+ * Cada bloco leva ~20 ms de hashing para um worker (potência de 2 entre
+ * STREAM_MIN_BLOCK_SIZE e STREAM_MAX_BLOCK_SIZE), com quatro slots por
+ * worker e no máximo STREAM_MAX_BUFFER no total.
+ */
+void stream_size_for_rate(double rate_per_worker, int num_workers, int *num_slots, size_t *block_size);
+
+/**
+ * Mapeia uma memória compartilhada já criada (lado do worker)
+ * 
+ * @param fd Descritor herdado do coordinator
+ * @return 0 em sucesso, -1 em erro (errno preenchido)
+ */
+int stream_attach(StreamBuffer *stream, int fd);
+
+/**
+ * Desfaz o mapeamento e fecha o descritor
+ */
+void stream_destroy(StreamBuffer *stream);
+
+/**
+ * Endereço dos dados de um slot
+ */
+char *stream_slot(const StreamBuffer *stream, int slot);
+
+/**
+ * Envia um índice de slot por um pipe (escrita atômica de um int)
+ * 
+ * @return 1 se enviado, 0 se o outro lado fechou o pipe
+ */
+int stream_send_slot(int fd, int slot);
+
+/**
+ * Recebe um índice de slot de um pipe
+ * 
+ * @return 1 se recebido, 0 se o pipe foi fechado por todos os escritores
+ */
+int stream_recv_slot(int fd, int *slot);
+
+#endif // STREAM_UTILS_H
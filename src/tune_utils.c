@@ -0,0 +1,289 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sched.h>
+#include <dirent.h>
+#include <time.h>
+#include <sys/wait.h>
+#include "hash_utils.h"
+#include "tune_utils.h"
+
+#define TUNE_BATCH 64                     // Hashes entre leituras do relógio na calibração
+#define TUNE_SMT_MARGIN 1.03              // SMT só vale se ganhar mais de 3%
+
+/**
+ * Lê um inteiro de um arquivo do sysfs
+ * 
+ * @return O valor lido, ou fallback se o arquivo não existir
+ */
+static int read_sysfs_int(const char *path, int fallback) {
+    FILE *file = fopen(path, "r");
+    int value;
+
+    if (!file) {
+        return fallback;
+    }
+    if (fscanf(file, "%d", &value) != 1) {
+        value = fallback;
+    }
+    fclose(file);
+    return value;
+}
+
+/**
+ * Lê uma lista de CPUs do sysfs no formato "0-3,8,10-11"
+ * 
+ * @return 0 em sucesso, -1 se o arquivo não existir ou estiver malformado
+ */
+static int read_sysfs_cpu_list(const char *path, cpu_set_t *set) {
+    FILE *file = fopen(path, "r");
+    char list[1024];
+    int ok = 0;
+
+    if (!file) {
+        return -1;
+    }
+    CPU_ZERO(set);
+    if (fgets(list, sizeof(list), file)) {
+        char *range = strtok(list, ",\n");
+        while (range) {
+            int first, last;
+            int fields = sscanf(range, "%d-%d", &first, &last);
+            if (fields < 1) {
+                break;
+            }
+            if (fields == 1) {
+                last = first;
+            }
+            for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++) {
+                CPU_SET(cpu, set);
+                ok = 1;
+            }
+            range = strtok(NULL, ",\n");
+        }
+    }
+    fclose(file);
+    return ok ? 0 : -1;
+}
+
+/**
+ * Procura o link "nodeN" dentro do diretório do CPU no sysfs
+ */
+static int read_cpu_node(int cpu) {
+    char path[64];
+    struct dirent *entry;
+    int node = 0;
+
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d", cpu);
+    DIR *dir = opendir(path);
+    if (!dir) {
+        return 0;
+    }
+    while ((entry = readdir(dir)) != NULL) {
+        if (sscanf(entry->d_name, "node%d", &node) == 1) {
+            break;
+        }
+    }
+    closedir(dir);
+    return node;
+}
+
+int read_cpu_topology(CpuTopology *topology) {
+    cpu_set_t allowed;
+    cpu_set_t siblings;
+    int packages[TUNE_MAX_CPUS];
+    int cores[TUNE_MAX_CPUS];
+    char path[96];
+
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) < 0) {
+        return -1;
+    }
+
+    memset(topology, 0, sizeof(*topology));
+    for (int cpu = 0; cpu < CPU_SETSIZE && topology->num_cpus < TUNE_MAX_CPUS; cpu++) {
+        if (!CPU_ISSET(cpu, &allowed)) {
+            continue;
+        }
+
+        int i = topology->num_cpus++;
+        topology->cpus[i] = cpu;
+        topology->nodes[i] = read_cpu_node(cpu);
+
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpu);
+        packages[i] = read_sysfs_int(path, 0);
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/core_id", cpu);
+        cores[i] = read_sysfs_int(path, -1 - cpu);  // Sem sysfs: cada CPU é um núcleo
+
+        // Primeiro CPU permitido de cada núcleo físico. Os irmãos SMT vêm de
+        // thread_siblings_list: core_id pode se repetir entre dies do mesmo pacote
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", cpu);
+        int has_siblings_list = read_sysfs_cpu_list(path, &siblings) == 0;
+
+        topology->primary[i] = 1;
+        for (int j = 0; j < i; j++) {
+            int same_core = has_siblings_list
+                ? CPU_ISSET(topology->cpus[j], &siblings)
+                : packages[j] == packages[i] && cores[j] == cores[i];
+            if (same_core) {
+                topology->primary[i] = 0;
+                break;
+            }
+        }
+        topology->num_cores += topology->primary[i];
+
+        int new_node = 1;
+        for (int j = 0; j < i; j++) {
+            if (topology->nodes[j] == topology->nodes[i]) {
+                new_node = 0;
+                break;
+            }
+        }
+        topology->num_nodes += new_node;
+    }
+
+    return topology->num_cpus > 0 ? 0 : -1;
+}
+
+/**
+ * Segundos decorridos desde start
+ */
+static double elapsed_since(const struct timespec *start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/**
+ * Rodada de calibração de um processo: hasheia com o mesmo caminho MD5
+ * do modo que vai rodar até acabar o tempo
+ * 
+ * @return Senhas/s medidas
+ */
+static double hash_burst(TuneKernel kernel) {
+    uint8_t blocks[TUNE_BATCH][MD5_BLOCK_SIZE];
+    uint8_t digests[TUNE_BATCH][MD5_DIGEST_LENGTH];
+    char candidate[] = "calibrar";
+    char hex[33];
+    long long hashes = 0;
+    struct timespec start;
+    double elapsed;
+
+    for (int i = 0; i < TUNE_BATCH; i++) {
+        md5_block_init(blocks[i], 8);
+        memcpy(blocks[i], candidate, 8);
+        blocks[i][0] = (uint8_t)i;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do {
+        switch (kernel) {
+            case TUNE_KERNEL_STRING:
+                for (int i = 0; i < TUNE_BATCH; i++) {
+                    md5_string(candidate, hex);
+                    candidate[i % 8] = 'a' + (hex[0] & 15);
+                }
+                break;
+            case TUNE_KERNEL_BLOCK:
+                for (int i = 0; i < TUNE_BATCH; i++) {
+                    md5_block_digest(blocks[i], digests[i]);
+                }
+                break;
+            case TUNE_KERNEL_BATCH:
+                md5_block_digest_batch(blocks, digests, TUNE_BATCH);
+                break;
+        }
+        blocks[0][1] = digests[0][0];  // Cada rodada depende da anterior
+        hashes += TUNE_BATCH;
+        elapsed = elapsed_since(&start);
+    } while (elapsed < TUNE_BURST_SECONDS);
+
+    return hashes / elapsed;
+}
+
+double measure_hash_rate(TuneKernel kernel, const int cpus[], int count) {
+    pid_t children[TUNE_MAX_CPUS];
+    int results[2];
+    double total = 0;
+
+    if (pipe(results) < 0) {
+        return 0;
+    }
+
+    for (int i = 0; i < count; i++) {
+        children[i] = fork();
+        if (children[i] < 0) {
+            count = i;
+            break;
+        }
+        if (children[i] == 0) {
+            close(results[0]);
+            pin_to_cpu(cpus[i]);
+            double rate = hash_burst(kernel);
+            write(results[1], &rate, sizeof(rate));
+            _exit(0);
+        }
+    }
+    close(results[1]);
+
+    // Cada filho escreve um double (menor que PIPE_BUF, sem intercalação)
+    double rate;
+    while (read(results[0], &rate, sizeof(rate)) == sizeof(rate)) {
+        total += rate;
+    }
+    close(results[0]);
+
+    for (int i = 0; i < count; i++) {
+        waitpid(children[i], NULL, 0);
+    }
+    return total;
+}
+
+int autotune_workers(TuneKernel kernel, TuneResult *result) {
+    CpuTopology topology;
+    int cores[TUNE_MAX_CPUS];
+    int num_cores = 0;
+
+    if (read_cpu_topology(&topology) < 0) {
+        return -1;
+    }
+    memset(result, 0, sizeof(*result));
+
+    int num_all = topology.num_cpus;
+    for (int i = 0; i < num_all; i++) {
+        if (topology.primary[i]) {
+            cores[num_cores++] = topology.cpus[i];
+        }
+    }
+
+    result->rate_all = measure_hash_rate(kernel, topology.cpus, num_all);
+    if (num_cores < num_all) {
+        result->rate_cores = measure_hash_rate(kernel, cores, num_cores);
+    }
+
+    result->use_smt = result->rate_cores > 0 && result->rate_all > result->rate_cores * TUNE_SMT_MARGIN;
+    if (result->use_smt || result->rate_cores == 0) {
+        result->num_workers = num_all;
+        memcpy(result->cpus, topology.cpus, num_all * sizeof(int));
+    } else {
+        result->num_workers = num_cores;
+        memcpy(result->cpus, cores, num_cores * sizeof(int));
+    }
+
+    double best_rate = result->num_workers == num_all ? result->rate_all : result->rate_cores;
+    result->rate_per_worker = best_rate / result->num_workers;
+
+    result->num_cpus = topology.num_cpus;
+    result->num_cores = topology.num_cores;
+    result->num_nodes = topology.num_nodes;
+    return 0;
+}
+
+int pin_to_cpu(int cpu) {
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set);
+}
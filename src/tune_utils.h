@@ -0,0 +1,85 @@
+#ifndef TUNE_UTILS_H
+#define TUNE_UTILS_H
+
+#include <stddef.h>
+
+#define TUNE_MAX_CPUS 1024
+#define TUNE_BURST_SECONDS 0.25  // Duração de cada rodada de calibração
+
+/**
+ * Caminho MD5 medido na calibração: o mesmo que os workers do modo usam
+ */
+typedef enum {
+    TUNE_KERNEL_STRING,  // md5_string (modo charset)
+    TUNE_KERNEL_BLOCK,   // md5_block_digest (modo híbrido)
+    TUNE_KERNEL_BATCH    // md5_block_digest_batch (modo stream)
+} TuneKernel;
+
+/**
+ * Topologia dos CPUs em que o processo pode rodar
+ * 
+ * Lida de sched_getaffinity e de /sys/devices/system/cpu: os irmãos SMT
+ * vêm de thread_siblings_list (core_id só quando a lista não existe) e os
+ * nós NUMA só entram no relatório. Sem sysfs, cada CPU lógico é tratado
+ * como um núcleo físico no nó NUMA 0.
+ */
+typedef struct {
+    int num_cpus;               // CPUs lógicos permitidos
+    int cpus[TUNE_MAX_CPUS];    // Ids dos CPUs permitidos
+    int nodes[TUNE_MAX_CPUS];   // Nó NUMA de cada CPU
+    int primary[TUNE_MAX_CPUS]; // 1 se é o primeiro CPU lógico do seu núcleo físico
+    int num_cores;              // Núcleos físicos distintos
+    int num_nodes;              // Nós NUMA distintos
+} CpuTopology;
+
+/**
+ * Decisão do modo automático
+ */
+typedef struct {
+    int num_cpus;               // CPUs lógicos permitidos
+    int num_cores;              // Núcleos físicos entre eles
+    int num_nodes;              // Nós NUMA entre eles
+    int num_workers;            // Workers escolhidos
+    int cpus[TUNE_MAX_CPUS];    // CPU em que cada worker será fixado
+    int use_smt;                // 1 se usa os irmãos SMT, 0 se um worker por núcleo
+    double rate_all;            // Senhas/s agregadas usando todos os CPUs lógicos
+    double rate_cores;          // Senhas/s agregadas com um worker por núcleo (0 sem SMT)
+    double rate_per_worker;     // Senhas/s de cada worker na configuração escolhida
+} TuneResult;
+
+/**
+ * Lê a topologia dos CPUs permitidos para este processo
+ * 
+ * @return 0 em sucesso, -1 se sched_getaffinity falhar
+ */
+int read_cpu_topology(CpuTopology *topology);
+
+/**
+ * Mede a taxa agregada de hashes com um processo de calibração fixado em cada CPU
+ * 
+ * @param kernel Caminho MD5 a medir
+ * @param cpus CPUs a usar
+ * @param count Quantidade de CPUs
+ * @return Senhas/s somadas de todos os processos
+ */
+double measure_hash_rate(TuneKernel kernel, const int cpus[], int count);
+
+/**
+ * Escolhe número de workers e CPUs pela maior taxa medida
+ * 
+ * Mede a taxa com todos os CPUs lógicos e, se houver SMT, com um CPU por
+ * núcleo físico. Os workers ficam na ordem dos ids de CPU.
+ * 
+ * @param kernel Caminho MD5 usado pelos workers do modo
+ * @return 0 em sucesso, -1 se a topologia não pôde ser lida
+ */
+int autotune_workers(TuneKernel kernel, TuneResult *result);
+
+/**
+ * Fixa o processo atual em um CPU (herdado através do execl)
+ * 
+ * @return 0 em sucesso, -1 em erro
+ */
+int pin_to_cpu(int cpu);
+
+#endif // TUNE_UTILS_H
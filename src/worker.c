@@ -6,6 +6,8 @@
 #include <sys/types.h>
 #include <time.h>
 #include "hash_utils.h"
+#include "mask_utils.h"
+#include "stream_utils.h"
 
 /**
  * PROCESSO TRABALHADOR - Mini-Projeto 1: Quebra de Senhas Paralelo
@@ -18,6 +20,9 @@
 
 #define RESULT_FILE "password_found.txt"
 #define PROGRESS_INTERVAL 100000  // Reportar progresso a cada N senhas
+#define HYBRID_FLAG "--hybrid"
+#define STREAM_FLAG "--stream"
+#define STREAM_BATCH 64           // Candidatos por lote no modo stream (múltiplo de MD5_BATCH_SIZE)
 
 /**
  * Incrementa uma senha para a próxima na ordem lexicográfica (aaa -> aab -> aac...)
@@ -78,17 +83,313 @@ void save_result(int worker_id, const char *password) {
     // IMPLEMENTE AQUI:
     int fd = open(RESULT_FILE, O_CREAT | O_EXCL | O_WRONLY, 0644);
     if (fd >= 0) {
-        char buffer[128];
-        int len = snprintf(buffer, sizeof(buffer), "%d:%s\n", worker_id, password);
-        write(fd, buffer, len);
+        // dprintf: candidatos dos modos híbrido e stream podem ter qualquer tamanho
+        dprintf(fd, "%d:%s\n", worker_id, password);
         close(fd);
     }
 }
 
+/**
+ * Imprime e salva um candidato encontrado que não termina em '\0'
+ * (bloco MD5 ou linha da memória compartilhada)
+ */
+void report_found(int worker_id, const void *candidate, size_t len) {
+    char *password = malloc(len + 1);
+    if (!password) {
+        perror("malloc falhou");
+        return;
+    }
+    memcpy(password, candidate, len);
+    password[len] = '\0';
+    printf("[Worker %d] SENHA ENCONTRADA: %s\n", worker_id, password);
+    save_result(worker_id, password);
+    free(password);
+}
+
+/**
+ * Modo híbrido: para cada palavra da faixa, enumera a máscara como sufixo
+ * ou prefixo. A palavra é gravada no bloco MD5 uma única vez; a cada
+ * candidato só as posições da máscara que mudaram são reescritas.
+ * Palavra + máscara maiores que um bloco usam o caminho MD5 completo (md5_digest).
+ * * Uso interno: ./worker --hybrid <hash> <wordlist> <offset> <num_palavras> <mascara> <sufixo|prefixo> <id>
+ */
+int run_hybrid(int argc, char *argv[]) {
+    if (argc != 9) {
+        fprintf(stderr, "Uso interno: %s %s <hash> <wordlist> <offset> <num_palavras> <mascara> <sufixo|prefixo> <id>\n",
+                argv[0], HYBRID_FLAG);
+        return 1;
+    }
+
+    const char *target_hash = argv[2];
+    const char *wordlist_path = argv[3];
+    long long offset = atoll(argv[4]);
+    long long word_count = atoll(argv[5]);
+    const char *mask_text = argv[6];
+    int mask_is_prefix = strcmp(argv[7], "prefixo") == 0;
+    int worker_id = atoi(argv[8]);
+
+    uint8_t target_digest[MD5_DIGEST_LENGTH];
+    Mask mask;
+    if (!md5_hex_to_digest(target_hash, target_digest) || !parse_mask(mask_text, &mask)) {
+        fprintf(stderr, "[Worker %d] Hash ou máscara inválidos.\n", worker_id);
+        return 1;
+    }
+
+    FILE *wordlist = fopen(wordlist_path, "r");
+    if (!wordlist || fseek(wordlist, offset, SEEK_SET) != 0) {
+        perror("Erro ao abrir wordlist");
+        return 1;
+    }
+
+    printf("[Worker %d] Iniciado: %lld palavras a partir do byte %lld\n", worker_id, word_count, offset);
+
+    uint8_t block[MD5_BLOCK_SIZE];
+    uint8_t digest[MD5_DIGEST_LENGTH];
+    int indexes[MASK_MAX_POSITIONS];
+    char *word = NULL;
+    size_t capacity = 0;
+    uint8_t *long_message = NULL;  // Candidato que não cabe em um bloco
+    size_t long_capacity = 0;
+    long long long_words = 0;
+    int stop = 0;
+
+    long long passwords_checked = 0;
+    long long next_check = PROGRESS_INTERVAL;
+    time_t start_time = time(NULL);
+
+    for (long long w = 0; w < word_count && !stop; w++) {
+        ssize_t word_len = getline(&word, &capacity, wordlist);
+        if (word_len == -1) {
+            break;
+        }
+        while (word_len > 0 && (word[word_len - 1] == '\n' || word[word_len - 1] == '\r')) {
+            word_len--;
+        }
+
+        size_t message_len = word_len + mask.length;
+        uint8_t *message = block;
+        int single_block = md5_block_init(block, message_len);
+        if (!single_block) {
+            // Não cabe em um bloco junto com a máscara: caminho completo, mais lento
+            if (message_len > long_capacity) {
+                uint8_t *grown = realloc(long_message, message_len);
+                if (!grown) {
+                    perror("realloc falhou");
+                    break;
+                }
+                long_message = grown;
+                long_capacity = message_len;
+            }
+            message = long_message;
+            long_words++;
+        }
+
+        uint8_t *mask_bytes = mask_is_prefix ? message : message + word_len;
+        memcpy(mask_is_prefix ? message + mask.length : message, word, word_len);
+        for (int i = 0; i < mask.length; i++) {
+            indexes[i] = 0;
+            mask_bytes[i] = mask.chars[i][0];
+        }
+
+        while (1) {
+            // Parada antecipada: a cada PROGRESS_INTERVAL senhas
+            if (passwords_checked >= next_check) {
+                next_check = passwords_checked + PROGRESS_INTERVAL;
+                if (check_result_exists()) {
+                    printf("[Worker %d] Outro worker encontrou a senha. Encerrando.\n", worker_id);
+                    stop = 1;
+                    break;
+                }
+            }
+
+            if (single_block) {
+                md5_block_digest(block, digest);
+            } else {
+                md5_digest(message, message_len, digest);
+            }
+            passwords_checked++;
+
+            if (memcmp(digest, target_digest, MD5_DIGEST_LENGTH) == 0) {
+                report_found(worker_id, message, message_len);
+                stop = 1;
+                break;
+            }
+
+            // Próxima combinação da máscara (mesmo algoritmo de increment_password)
+            int pos = mask.length - 1;
+            while (pos >= 0 && indexes[pos] == mask.counts[pos] - 1) {
+                indexes[pos] = 0;
+                mask_bytes[pos] = mask.chars[pos][0];
+                pos--;
+            }
+            if (pos < 0) {
+                break;
+            }
+            indexes[pos]++;
+            mask_bytes[pos] = mask.chars[pos][indexes[pos]];
+        }
+    }
+
+    free(word);
+    free(long_message);
+    fclose(wordlist);
+
+    time_t end_time = time(NULL);
+    double total_time = difftime(end_time, start_time);
+
+    printf("[Worker %d] Finalizado. Total: %lld senhas em %.2f segundos",
+           worker_id, passwords_checked, total_time);
+    if (total_time > 0) {
+        printf(" (%.0f senhas/s)", passwords_checked / total_time);
+    }
+    if (long_words > 0) {
+        printf(" - %lld palavras maiores que um bloco MD5", long_words);
+    }
+    printf("\n");
+
+    return 0;
+}
+
+/**
+ * Calcula os hashes de um lote de candidatos e compara com o alvo
+ * * @return Índice do candidato encontrado no lote, ou -1
+ */
+int check_batch(uint8_t blocks[][MD5_BLOCK_SIZE], int count, const uint8_t target_digest[MD5_DIGEST_LENGTH]) {
+    uint8_t digests[STREAM_BATCH][MD5_DIGEST_LENGTH];
+
+    md5_block_digest_batch(blocks, digests, count);
+    for (int i = 0; i < count; i++) {
+        if (memcmp(digests[i], target_digest, MD5_DIGEST_LENGTH) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Modo stream: recebe blocos de candidatos (um por linha) do coordinator
+ * por memória compartilhada e calcula os hashes em lotes de STREAM_BATCH.
+ * * Uso interno: ./worker --stream <hash> <shm_fd> <work_fd> <free_fd> <id>
+ */
+int run_stream(int argc, char *argv[]) {
+    if (argc != 7) {
+        fprintf(stderr, "Uso interno: %s %s <hash> <shm_fd> <work_fd> <free_fd> <id>\n",
+                argv[0], STREAM_FLAG);
+        return 1;
+    }
+
+    const char *target_hash = argv[2];
+    int shm_fd = atoi(argv[3]);
+    int work_fd = atoi(argv[4]);
+    int free_fd = atoi(argv[5]);
+    int worker_id = atoi(argv[6]);
+
+    uint8_t target_digest[MD5_DIGEST_LENGTH];
+    if (!md5_hex_to_digest(target_hash, target_digest)) {
+        fprintf(stderr, "[Worker %d] Hash inválido.\n", worker_id);
+        return 1;
+    }
+
+    StreamBuffer stream;
+    if (stream_attach(&stream, shm_fd) < 0) {
+        perror("Erro ao mapear memória compartilhada");
+        return 1;
+    }
+
+    printf("[Worker %d] Iniciado: aguardando blocos de candidatos\n", worker_id);
+
+    uint8_t blocks[STREAM_BATCH][MD5_BLOCK_SIZE];
+    const char *candidates[STREAM_BATCH];
+    size_t lengths[STREAM_BATCH];
+
+    long long passwords_checked = 0;
+    long long long_lines = 0;
+    long long blocks_done = 0;
+    int stop = 0;
+    int slot;
+    time_t start_time = time(NULL);
+
+    while (!stop && stream_recv_slot(work_fd, &slot) && slot != STREAM_END_SLOT) {
+        // Parada antecipada: checada uma vez por bloco
+        if (check_result_exists()) {
+            printf("[Worker %d] Outro worker encontrou a senha. Encerrando.\n", worker_id);
+            break;
+        }
+
+        const char *line = stream_slot(&stream, slot);
+        const char *end = line + stream.header->lengths[slot];
+        int count = 0;
+
+        while (line < end && !stop) {
+            const char *newline = memchr(line, '\n', end - line);
+            const char *line_end = newline ? newline : end;
+            size_t len = line_end - line;
+            if (len > 0 && line[len - 1] == '\r') {
+                len--;
+            }
+
+            if (md5_block_init(blocks[count], len)) {
+                memcpy(blocks[count], line, len);
+                candidates[count] = line;
+                lengths[count] = len;
+                count++;
+            } else {
+                // Maior que um bloco MD5: fora do lote, caminho completo direto da memória compartilhada
+                uint8_t digest[MD5_DIGEST_LENGTH];
+                md5_digest((const uint8_t *)line, len, digest);
+                passwords_checked++;
+                long_lines++;
+                if (memcmp(digest, target_digest, MD5_DIGEST_LENGTH) == 0) {
+                    report_found(worker_id, line, len);
+                    stop = 1;
+                }
+            }
+            line = line_end + 1;
+
+            if (count == STREAM_BATCH || (line >= end && count > 0)) {
+                int hit = check_batch(blocks, count, target_digest);
+                passwords_checked += count;
+                if (hit >= 0) {
+                    report_found(worker_id, candidates[hit], lengths[hit]);
+                    stop = 1;
+                }
+                count = 0;
+            }
+        }
+
+        blocks_done++;
+        stream_send_slot(free_fd, slot);
+    }
+
+    stream_destroy(&stream);
+
+    time_t end_time = time(NULL);
+    double total_time = difftime(end_time, start_time);
+
+    printf("[Worker %d] Finalizado. Total: %lld senhas (%lld blocos) em %.2f segundos",
+           worker_id, passwords_checked, blocks_done, total_time);
+    if (total_time > 0) {
+        printf(" (%.0f senhas/s)", passwords_checked / total_time);
+    }
+    if (long_lines > 0) {
+        printf(" - %lld linhas maiores que um bloco MD5", long_lines);
+    }
+    printf("\n");
+
+    return 0;
+}
+
 /**
  * Função principal do worker
  */
 int main(int argc, char *argv[]) {
+    if (argc > 1 && strcmp(argv[1], HYBRID_FLAG) == 0) {
+        return run_hybrid(argc, argv);
+    }
+    if (argc > 1 && strcmp(argv[1], STREAM_FLAG) == 0) {
+        return run_stream(argc, argv);
+    }
+    
     // Validar argumentos
     if (argc != 7) {
         fprintf(stderr, "Uso interno: %s <hash> <start> <end> <charset> <len> <id>\n", argv[0]);
@@ -98,6 +98,35 @@ run_test() {
     fi
 }
 
+# Função para teste do modo híbrido (wordlist + máscara)
+run_hybrid_test() {
+    local test_name="$1"
+    local hash="$2"
+    local mask="$3"
+    local position="$4"
+    local expected_password="$5"
+    
+    echo -e "\n${YELLOW}[Teste Híbrido] $test_name${NC}"
+    echo "Máscara: '$mask' ($position), senha esperada: '$expected_password'"
+    
+    rm -f password_found.txt
+    printf 'password\nsummer\nwinter\nadmin\nqwerty\n' > wordlist_test.tmp
+    timeout 30s ./coordinator --hybrid "$hash" wordlist_test.tmp "$mask" 3 "$position" > test_output.tmp 2>&1
+    
+    local found_password=""
+    if [ -f "password_found.txt" ]; then
+        found_password=$(cut -d':' -f2 password_found.txt | tr -d '\n\r ')
+    fi
+    if [ "$found_password" = "$expected_password" ]; then
+        echo -e "${GREEN}✓ PASSOU: Senha '$found_password' encontrada corretamente${NC}"
+        TESTS_PASSED=$((TESTS_PASSED + 1))
+    else
+        echo -e "${RED}✗ FALHOU: Senha esperada '$expected_password', encontrada '$found_password'${NC}"
+        cat test_output.tmp
+        TESTS_FAILED=$((TESTS_FAILED + 1))
+    fi
+}
+
 # Função para teste de performance
 performance_test() {
     local test_name="$1"
@@ -192,6 +221,72 @@ run_test "Charset Maior" \
     "4" \
     "hello"
 
+# Teste 6: Número de workers automático (topologia + calibração)
+run_test "Workers Automático (auto)" \
+    "5d41402abc4b2a76b9719d911017c592" \
+    "5" \
+    "abcdefghijklmnopqrstuvwxyz" \
+    "auto" \
+    "hello"
+
+# Teste 7: Modo híbrido - palavra + sufixo
+run_hybrid_test "Palavra + Sufixo (summer2024!)" \
+    "3fb39f7f2966115ff647c5781c8b4ce1" \
+    "?d?d?d?d?s" \
+    "sufixo" \
+    "summer2024!"
+
+# Teste 8: Modo híbrido - prefixo + palavra
+run_hybrid_test "Prefixo + Palavra (12admin)" \
+    "$(echo -n '12admin' | md5sum | cut -d' ' -f1)" \
+    "?d?d" \
+    "prefixo" \
+    "12admin"
+
+# Teste 9: Modo stream - candidatos externos pela entrada padrão
+echo -e "\n${YELLOW}[Teste Stream] Candidatos pela entrada padrão (1999999)${NC}"
+rm -f password_found.txt
+seq 1 2000000 | timeout 30s ./coordinator --stream "$(echo -n '1999999' | md5sum | cut -d' ' -f1)" 3 > test_output.tmp 2>&1
+STREAM_FOUND=""
+if [ -f "password_found.txt" ]; then
+    STREAM_FOUND=$(cut -d':' -f2 password_found.txt | tr -d '\n\r ')
+fi
+if [ "$STREAM_FOUND" = "1999999" ]; then
+    echo -e "${GREEN}✓ PASSOU: Senha '$STREAM_FOUND' encontrada corretamente${NC}"
+    TESTS_PASSED=$((TESTS_PASSED + 1))
+else
+    echo -e "${RED}✗ FALHOU: Senha esperada '1999999', encontrada '$STREAM_FOUND'${NC}"
+    cat test_output.tmp
+    TESTS_FAILED=$((TESTS_FAILED + 1))
+fi
+
+# Teste 10: Modo stream - o fim de uma linha maior que o bloco não vira candidato
+echo -n "Stream com linha maior que o bloco: "
+rm -f password_found.txt
+{ head -c 2097152 /dev/zero | tr '\0' 'x'; printf 'secret\n1\n2\n'; } | \
+    timeout 30s ./coordinator --stream "$(echo -n 'secret' | md5sum | cut -d' ' -f1)" 2 >/dev/null 2>&1
+if [ ! -f "password_found.txt" ]; then
+    echo -e "${GREEN}✓ Linha longa descartada (correto)${NC}"
+    TESTS_PASSED=$((TESTS_PASSED + 1))
+else
+    echo -e "${RED}✗ Não deveria encontrar senha: $(cat password_found.txt)${NC}"
+    TESTS_FAILED=$((TESTS_FAILED + 1))
+fi
+
+# Teste 11: Modo stream - candidato maior que um bloco MD5 (56+ bytes) também é hasheado
+echo -n "Stream com senha longa: "
+rm -f password_found.txt
+LONG_PASSWORD="correct horse battery staple is a long passphrase 2024!"
+printf 'curta\n%s\noutra\n' "$LONG_PASSWORD" | \
+    timeout 30s ./coordinator --stream "$(echo -n "$LONG_PASSWORD" | md5sum | cut -d' ' -f1)" 2 >/dev/null 2>&1
+if [ -f "password_found.txt" ] && [ "$(cut -d':' -f2- password_found.txt)" = "$LONG_PASSWORD" ]; then
+    echo -e "${GREEN}✓ Senha longa encontrada (correto)${NC}"
+    TESTS_PASSED=$((TESTS_PASSED + 1))
+else
+    echo -e "${RED}✗ Senha longa não encontrada${NC}"
+    TESTS_FAILED=$((TESTS_FAILED + 1))
+fi
+
 # Teste de Performance
 echo -e "\n${YELLOW}[Teste de Performance] Speedup com Múltiplos Workers${NC}"
 echo "Testando se paralelização realmente acelera a busca:"
@@ -238,7 +333,7 @@ else
 fi
 
 # Limpeza
-rm -f test_output.tmp password_found.txt
+rm -f test_output.tmp wordlist_test.tmp password_found.txt
 
 # Resultado final
 echo -e "\n=== Resultado Final ==="